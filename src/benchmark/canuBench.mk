@@ -0,0 +1,21 @@
+#  If 'make' isn't run from the root directory, we need to set these to
+#  point to the upper level build directory.
+ifeq "$(strip ${BUILD_DIR})" ""
+  BUILD_DIR    := ../$(OSTYPE)-$(MACHINETYPE)/obj
+endif
+ifeq "$(strip ${TARGET_DIR})" ""
+  TARGET_DIR   := ../$(OSTYPE)-$(MACHINETYPE)
+endif
+
+TARGET   := canuBench
+SOURCES  := canuBench.C \
+            canuBench-ped.C \
+            ../meryl/merylCountArray.C
+
+SRC_INCDIRS  := .. ../utility ../stores ../meryl ../overlapInCore/liboverlap ../overlapInCore/libedlib ../utgcns/libNDalign ../utgcns/libcns
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -lcanu
+TGT_PREREQS := libcanu.a
+
+SUBMAKEFILES :=
@@ -0,0 +1,314 @@
+#!/usr/bin/env perl
+
+###############################################################################
+ #
+ #  This file is part of canu, a software program that assembles whole-genome
+ #  sequencing reads into contigs.
+ #
+ #  This software is based on:
+ #    'Celera Assembler' (http://wgs-assembler.sourceforge.net)
+ #    the 'kmer package' (http://kmer.sourceforge.net)
+ #  both originally distributed by Applera Corporation under the GNU General
+ #  Public License, version 2.
+ #
+ #  Canu branched from Celera Assembler at its revision 4587.
+ #  Canu branched from the kmer project at its revision 1994.
+ #
+ #  Modifications by:
+ #
+ #  File 'README.licenses' in the root directory of this distribution contains
+ #  full conditions and disclaimers for each license.
+ ##
+
+#  Assemble a small simulated genome with canu, on this machine, and report
+#  the wall time, CPU time and peak memory of each stage.
+#
+#  The genome and reads come from 'sequence generate' and 'fastqSimulate'
+#  with a fixed seed, so every run does the same work.  Canu is run once
+#  each for correction, trimming and assembly, so the same program run in
+#  different steps can be told apart.  Each program canu runs writes its
+#  own statistics to canu-logs/*.stats.json; these are collected into one
+#  line per step and program.  A stage run as several jobs reports the
+#  elapsed time from the first start to the last finish, and the CPU time
+#  of all jobs.
+#
+#  With -compare, the report is compared against an earlier one, and stages
+#  that got slower are flagged.
+
+use strict;
+
+use FindBin;
+use Cwd qw(abs_path);
+
+my $bin        = $FindBin::RealBin;
+
+my $dir        = undef;
+my $seed       = 1;
+my $genomeSize = 100000;
+my $coverage   = 25;
+my $readLength = 5000;
+my $threads    = 4;
+my $memory     = 8;
+my $compare    = undef;
+my $tolerance  = 0.10;
+my $minTime    = 1.0;
+my @canuOpts;
+
+my $err = 0;
+
+while (scalar(@ARGV) > 0) {
+    my $arg = shift @ARGV;
+
+    if      ($arg eq "-d") {
+        $dir = shift @ARGV;
+
+    } elsif ($arg eq "-seed") {
+        $seed = shift @ARGV;
+
+    } elsif ($arg eq "-genomeSize") {
+        $genomeSize = shift @ARGV;
+
+    } elsif ($arg eq "-coverage") {
+        $coverage = shift @ARGV;
+
+    } elsif ($arg eq "-readLength") {
+        $readLength = shift @ARGV;
+
+    } elsif ($arg eq "-threads") {
+        $threads = shift @ARGV;
+
+    } elsif ($arg eq "-memory") {
+        $memory = shift @ARGV;
+
+    } elsif ($arg eq "-compare") {
+        $compare = shift @ARGV;
+
+    } elsif ($arg eq "-tolerance") {
+        $tolerance = shift @ARGV;
+
+    } elsif ($arg =~ m/^\w+=/) {
+        push @canuOpts, $arg;
+
+    } else {
+        print STDERR "ERROR: invalid arg '$arg'\n";
+        $err++;
+    }
+}
+
+if ((!defined($dir)) || ($err > 0)) {
+    print STDERR "usage: $0 -d dir [options] [canu-options]\n";
+    print STDERR "\n";
+    print STDERR "Assembles a simulated genome with canu, running every job on this machine,\n";
+    print STDERR "and reports wall time, CPU time and peak memory for each stage.\n";
+    print STDERR "\n";
+    print STDERR "  -d dir             work directory; must not exist.  The report is written\n";
+    print STDERR "                     to stdout and to 'dir/bench.json'.\n";
+    print STDERR "\n";
+    print STDERR "  -seed s            random number seed for the genome and reads (default $seed)\n";
+    print STDERR "  -genomeSize g      genome size, in bases (default $genomeSize)\n";
+    print STDERR "  -coverage c        read coverage (default $coverage)\n";
+    print STDERR "  -readLength l      read length (default $readLength)\n";
+    print STDERR "\n";
+    print STDERR "  -threads t         canu maxThreads (default $threads)\n";
+    print STDERR "  -memory m          canu maxMemory, in GB (default $memory)\n";
+    print STDERR "\n";
+    print STDERR "  -compare file      compare against the bench.json of an earlier run, and flag\n";
+    print STDERR "                     stages whose wall or CPU time increased by more than\n";
+    print STDERR "  -tolerance f       fraction f (default $tolerance).  Stages taking less than $minTime\n";
+    print STDERR "                     second are not flagged.  Exits with status 1 if any are.\n";
+    print STDERR "\n";
+    print STDERR "  Any 'option=value' words are passed to canu.\n";
+    print STDERR "\n";
+    print STDERR "ERROR: no work directory (-d) supplied.\n"   if (!defined($dir));
+    exit(1);
+}
+
+die "ERROR: work directory '$dir' exists.\n"   if (-e $dir);
+die "ERROR: can't read -compare file '$compare'.\n"   if ((defined($compare)) && (! -e $compare));
+
+mkdir($dir) or die "ERROR: can't make work directory '$dir': $!\n";
+
+$dir = abs_path($dir);
+
+
+
+#  Run a command, with stdout to $out and stderr to $log.
+sub runCommand ($$$) {
+    my $cmd = shift @_;
+    my $out = shift @_;
+    my $log = shift @_;
+
+    print STDERR "-- $cmd\n";
+
+    $cmd .= ($out eq $log) ? " > $log 2>&1" : " > $out 2> $log";
+
+    if (system($cmd) != 0) {
+        die "ERROR: command failed; see '$log'.\n";
+    }
+}
+
+
+
+#  Make the genome and reads, then assemble.  The simulator parameters are
+#  roughly raw PacBio: mostly insertions.
+
+runCommand("$bin/sequence generate -min $genomeSize -max $genomeSize -sequences 1 -seed $seed", "$dir/genome.fasta", "$dir/genome.err");
+
+runCommand("$bin/fastqSimulate -f $dir/genome.fasta -o $dir/reads -se -l $readLength -x $coverage -em 0.005 -ei 0.030 -ed 0.015 -seed $seed", "$dir/reads.err", "$dir/reads.err");
+
+my @steps     = ( "correct", "trim", "assemble" );
+my %stepInput = ( "correct"  => "-pacbio-raw $dir/reads.s.fastq",
+                  "trim"     => "-pacbio-corrected $dir/correct/bench.correctedReads.fasta.gz",
+                  "assemble" => "-pacbio-corrected $dir/trim/bench.trimmedReads.fasta.gz" );
+my %stepTime;
+
+foreach my $step (@steps) {
+    my $bgn = time();
+
+    runCommand("$bin/canu -$step -p bench -d $dir/$step $stepInput{$step} " .
+               "genomeSize=$genomeSize useGrid=false maxThreads=$threads maxMemory=$memory gnuplotTested=true " .
+               "corOverlapper=ovl obtOverlapper=ovl utgOverlapper=ovl " .
+               join(" ", @canuOpts), "$dir/$step.out", "$dir/$step.out");
+
+    $stepTime{$step} = time() - $bgn;
+}
+
+
+
+#  Load the statistics of every program canu ran, and merge them by step
+#  and program.
+
+my %stages;
+
+foreach my $file (map { glob("$dir/$_/canu-logs/*.stats.json") } @steps) {
+    my ($program, $start, $wall, $user, $sys, $rss);
+
+    open(F, "< $file") or die "ERROR: can't open '$file': $!\n";
+    while (<F>) {
+        $program = $1   if ((!defined($program)) && (m/^\s*"program":\s*"(.*)",$/));
+        $start   = $1   if ((!defined($start))   && (m/^\s*"startTime":\s*([0-9.]+),$/));
+        $wall    = $1   if ((!defined($wall))    && (m/^\s*"wallTime":\s*([0-9.]+),$/));
+        $user    = $1   if ((!defined($user))    && (m/^\s*"userTime":\s*([0-9.]+),$/));
+        $sys     = $1   if ((!defined($sys))     && (m/^\s*"systemTime":\s*([0-9.]+),$/));
+        $rss     = $1   if ((!defined($rss))     && (m/^\s*"peakRSS":\s*([0-9]+),$/));
+    }
+    close(F);
+
+    next   if (!defined($program) || !defined($start) || !defined($wall));
+
+    $program = "$1/$program"   if ($file =~ m!^\Q$dir\E/(\w+)/canu-logs/!);
+
+    if (!exists($stages{$program})) {
+        $stages{$program} = { jobs => 0, bgn => $start, end => $start + $wall, cpu => 0, rss => 0 };
+    }
+
+    my $s = $stages{$program};
+
+    $s->{jobs} += 1;
+    $s->{bgn}   = $start           if ($start < $s->{bgn});
+    $s->{end}   = $start + $wall   if ($s->{end} < $start + $wall);
+    $s->{cpu}  += $user + $sys;
+    $s->{rss}   = $rss             if ($s->{rss} < $rss);
+}
+
+my @order = sort { $stages{$a}->{bgn} <=> $stages{$b}->{bgn} } keys %stages;
+
+#  Count the contigs, to show the assembly worked.
+
+my $contigs     = 0;
+my $contigBases = 0;
+
+if (open(F, "< $dir/assemble/bench.contigs.fasta")) {
+    while (<F>) {
+        chomp;
+        if (m/^>/) {
+            $contigs++;
+        } else {
+            $contigBases += length($_);
+        }
+    }
+    close(F);
+}
+
+
+
+#  Load the earlier report to compare against.  Stages are written one per
+#  line, so there's no need for a real JSON parser.
+
+my %old;
+
+if (defined($compare)) {
+    open(F, "< $compare") or die "ERROR: can't open '$compare': $!\n";
+    while (<F>) {
+        if (m/"stage":\s*"(.*)",\s*"jobs":\s*(\d+),\s*"wallTime":\s*([0-9.]+),\s*"cpuTime":\s*([0-9.]+),\s*"peakRSS":\s*(\d+)/) {
+            $old{$1} = { wall => $3, cpu => $4, rss => $5 };
+        }
+    }
+    close(F);
+}
+
+
+
+#  Report.
+
+open(J, "> $dir/bench.json") or die "ERROR: can't open '$dir/bench.json' for writing: $!\n";
+
+print J "{\n";
+print J "  \"program\": \"canuBenchAssembly\",\n";
+print J "  \"seed\": $seed,\n";
+print J "  \"genomeSize\": $genomeSize,\n";
+print J "  \"coverage\": $coverage,\n";
+print J "  \"readLength\": $readLength,\n";
+print J "  \"threads\": $threads,\n";
+print J "  \"steps\": { " . join(", ", map { "\"$_\": $stepTime{$_}" } @steps) . " },\n";
+print J "  \"contigs\": $contigs,\n";
+print J "  \"contigBases\": $contigBases,\n";
+print J "  \"stages\": [";
+
+printf "%-32s %5s %10s %10s %10s", "stage", "jobs", "wall(s)", "cpu(s)", "RSS(MB)";
+printf " %8s %8s", "wall", "cpu"   if (defined($compare));
+printf "\n";
+
+my $slower = 0;
+
+for (my $ii=0; $ii < scalar(@order); $ii++) {
+    my $name = $order[$ii];
+    my $s    = $stages{$name};
+    my $wall = $s->{end} - $s->{bgn};
+
+    printf J "%s\n    { \"stage\": \"%s\", \"jobs\": %d, \"wallTime\": %.3f, \"cpuTime\": %.3f, \"peakRSS\": %d }",
+        ($ii == 0) ? "" : ",", $name, $s->{jobs}, $wall, $s->{cpu}, $s->{rss};
+
+    printf "%-32s %5d %10.3f %10.3f %10.1f", $name, $s->{jobs}, $wall, $s->{cpu}, $s->{rss} / 1048576;
+
+    if ((defined($compare)) && (exists($old{$name}))) {
+        my $o  = $old{$name};
+        my $wr = ($o->{wall} > 0) ? $wall      / $o->{wall} : 0;
+        my $cr = ($o->{cpu}  > 0) ? $s->{cpu}  / $o->{cpu}  : 0;
+
+        printf " %7.2fx %7.2fx", $wr, $cr;
+
+        if ((($wall      >= $minTime) && ($wr > 1 + $tolerance)) ||
+            (($s->{cpu}  >= $minTime) && ($cr > 1 + $tolerance))) {
+            printf "  SLOWER";
+            $slower++;
+        }
+    }
+
+    printf "\n";
+}
+
+print J "\n  ]\n";
+print J "}\n";
+
+close(J);
+
+printf "\n";
+printf "canu finished in %s seconds; %d contigs with %d bases.\n", join(" + ", map { "$stepTime{$_}" } @steps), $contigs, $contigBases;
+
+if (defined($compare)) {
+    printf "%d stage%s slower than '%s'.\n", $slower, ($slower == 1) ? " is" : "s are", $compare;
+    exit(1)   if ($slower > 0);
+}
+
+exit(0);
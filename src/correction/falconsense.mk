@@ -8,9 +8,9 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := falconsense
-SOURCES  := falconsense.C ../utgcns/stashContains.C
+SOURCES  := falconsense.C correctionLayout.C ../utgcns/stashContains.C
 
-SRC_INCDIRS  := .. ../utility ../stores ../utgcns
+SRC_INCDIRS  := .. ../utility ../stores ../utgcns ../overlapInCore
 
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
 TGT_LDLIBS  := -lcanu
@@ -8,7 +8,7 @@ ifeq "$(strip ${TARGET_DIR})" ""
 endif
 
 TARGET   := generateCorrectionLayouts
-SOURCES  := generateCorrectionLayouts.C ../utgcns/stashContains.C
+SOURCES  := generateCorrectionLayouts.C correctionLayout.C ../utgcns/stashContains.C
 
 SRC_INCDIRS  := .. ../utility ../stores ../utgcns
 
@@ -50,6 +50,7 @@ SOURCES      := AS_global.C \
                 utility/md5.C \
                 utility/mt19937ar.C \
                 utility/objectStore.C \
+                utility/runtimeStats.C \
                 utility/speedCounter.C \
                 utility/sweatShop.C \
                 \
@@ -158,13 +159,16 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
                 stores/ovStoreIndexer.mk \
+                stores/ovStoreAppend.mk \
                 stores/ovStoreDump.mk \
                 stores/ovStoreStats.mk \
                 stores/sqStoreCreate.mk \
                 stores/sqStoreCreatePartition.mk \
                 stores/sqStoreDumpFASTQ.mk \
                 stores/sqStoreDumpMetaData.mk \
+                stores/sqStoreWarm.mk \
                 stores/tgStoreCompress.mk \
+                stores/tgStoreConvert.mk \
                 stores/tgStoreDump.mk \
                 stores/tgStoreLoad.mk \
                 stores/tgStoreFilter.mk \
@@ -236,3 +240,8 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 fastq-utilities/fastqSimulate.mk \
                 fastq-utilities/fastqSimulate-sort.mk
 
+#  canuBench is built only for 'make bench'.
+ifneq ($(filter bench,${MAKECMDGOALS}),)
+SUBMAKEFILES += benchmark/canuBench.mk
+endif
+
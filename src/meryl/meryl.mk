@@ -16,6 +16,7 @@ SOURCES  := meryl.C \
             merylOp-countSimple.C \
             merylOp-histogram.C \
             merylOp-nextMer.C \
+            merylOp-threads.C \
             merylOp.C
 
 SRC_INCDIRS  := . .. ../utility ../stores
@@ -565,32 +565,35 @@ sub configureAssembler () {
     #  For uncorrected overlapper, both memory and thread count is reduced.  Memory because it is
     #  very CPU bound, and thread count because it can be quite unbalanced.
 
-    #  22 bits ->   864 MB table structure,   64 million kmers
-    #  23 bits ->  1728 MB table structure,  128 million kmers
-    #  24 bits ->  3456 MB table structure,  256 million kmers
-    #  25 bits ->  6912 MB table structure,  512 million kmers
-    #  26 bits -> 13824 MB table structure, 1024 million kmers
+    #  22 bits ->   960 MB table structure,   64 million kmers
+    #  23 bits ->  1920 MB table structure,  128 million kmers
+    #  24 bits ->  3840 MB table structure,  256 million kmers
+    #  25 bits ->  7680 MB table structure,  512 million kmers
+    #  26 bits -> 15360 MB table structure, 1024 million kmers
+    #
+    #  Each bucket is 240 bytes, plus 4 bytes in the check array.  The sizes below were measured
+    #  with 216 byte buckets; TABLE and W/DATA include the 24 bytes per bucket added since.
     #
     #    sequence generate -min 5000 -max 25000 -bases 10000000000                                   > random.fasta
     #    sequence generate -min 5000 -max 25000 -bases 10000000000 -a 0.9 -c 0.033 -g 0.033 -t 0.033 > repeat.fasta
     #
     #               TABLE    W/DATA
-    #    bits 20   216 MB -  2500 MB random -   16 million kmers at 75% load
-    #    bits 21   432 MB -  2750 MB random -   32 million kmers
+    #    bits 20   240 MB -  2524 MB random -   16 million kmers at 75% load
+    #    bits 21   480 MB -  2798 MB random -   32 million kmers
     #
-    #    bits 22   864 MB -  3000 MB random -   64 million kmers
+    #    bits 22   960 MB -  3096 MB random -   64 million kmers
     #
-    #    bits 23  1728 MB -  3500 MB random -  128 million kmers
+    #    bits 23  1920 MB -  3692 MB random -  128 million kmers
     #
-    #    bits 24  3456 MB -  5750 MB random -  200 million kmers at 56% load
-    #             3456 MB -  6500 MB random -  256 million kmers at 75% load
-    #             3456 MB -  8200 MB repeat -  256 million kmers at  5% load
+    #    bits 24  3840 MB -  6134 MB random -  200 million kmers at 56% load
+    #             3840 MB -  6884 MB random -  256 million kmers at 75% load
+    #             3840 MB -  8584 MB repeat -  256 million kmers at  5% load
     #
-    #    bits 25  6912 MB - 10000 MB random -  300 million kmers at 42% load
-    #             6912 MB - 12750 MB random -  512 million kmers at 75% load
-    #             6912 MB - 21000 MB repeat -  600 million kmers at  5% load
+    #    bits 25  7680 MB - 10768 MB random -  300 million kmers at 42% load
+    #             7680 MB - 13518 MB random -  512 million kmers at 75% load
+    #             7680 MB - 21768 MB repeat -  600 million kmers at  5% load
     #
-    #    bits 26 13824 MB - 25000 MB random - 1024 million kmers at 75% load
+    #    bits 26 15360 MB - 26536 MB random - 1024 million kmers at 75% load
     #
     #
     #  An expansion factor for the bases to load into the hash table.  Each table size will hold a
@@ -619,7 +622,7 @@ sub configureAssembler () {
         setGlobalIfUndef("corOvlHashBlockLength",     2500000);    setGlobalIfUndef("obtOvlHashBlockLength",   128 * $hx);    setGlobalIfUndef("utgOvlHashBlockLength",   128 * $hx);
         setGlobalIfUndef("corOvlRefBlockLength",      2000000);    setGlobalIfUndef("obtOvlRefBlockLength",   5000000000);    setGlobalIfUndef("utgOvlRefBlockLength",   5000000000);   #    5 Gbp
 
-        setGlobalIfUndef("corOvlMemory", "2");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 23);
+        setGlobalIfUndef("corOvlMemory", "3");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 23);
         setGlobalIfUndef("obtOvlMemory", "8");       setGlobalIfUndef("obtOvlThreads", "2-8");    setGlobalIfUndef("obtOvlHashBits", 23);
         setGlobalIfUndef("utgOvlMemory", "8");       setGlobalIfUndef("utgOvlThreads", "2-8");    setGlobalIfUndef("utgOvlHashBits", 23);
 
@@ -651,7 +654,7 @@ sub configureAssembler () {
         setGlobalIfUndef("corOvlHashBlockLength",     2500000);    setGlobalIfUndef("obtOvlHashBlockLength",   512 * $hx);    setGlobalIfUndef("utgOvlHashBlockLength",   512 * $hx);
         setGlobalIfUndef("corOvlRefBlockLength",      2000000);    setGlobalIfUndef("obtOvlRefBlockLength",  20000000000);    setGlobalIfUndef("utgOvlRefBlockLength",  20000000000);   #   20 Gbp
 
-        setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 25);
+        setGlobalIfUndef("corOvlMemory", "10");      setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 25);
         setGlobalIfUndef("obtOvlMemory", "24");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 25);
         setGlobalIfUndef("utgOvlMemory", "24");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 25);
 
@@ -667,7 +670,7 @@ sub configureAssembler () {
         setGlobalIfUndef("corOvlHashBlockLength",     2500000);    setGlobalIfUndef("obtOvlHashBlockLength",   512 * $hx);    setGlobalIfUndef("utgOvlHashBlockLength",   512 * $hx);
         setGlobalIfUndef("corOvlRefBlockLength",      2000000);    setGlobalIfUndef("obtOvlRefBlockLength",  30000000000);    setGlobalIfUndef("utgOvlRefBlockLength",  30000000000);   #   30 Gbp
 
-        setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 25);
+        setGlobalIfUndef("corOvlMemory", "10");      setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 25);
         setGlobalIfUndef("obtOvlMemory", "24");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 25);
         setGlobalIfUndef("utgOvlMemory", "24");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 25);
 
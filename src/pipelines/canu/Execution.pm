@@ -476,6 +476,12 @@ sub getBinDirectoryShellCode () {
     $string .= "  bin=\"$installDir\"\n";
     $string .= "fi\n";
     $string .= "\n";
+    if (getGlobal("sqStoreShared") == 1) {
+        $string .= "#  Map the seqStore so jobs on this node share one copy.\n";
+        $string .= "\n";
+        $string .= "export CANU_SQSTORE_SHARED=1\n";
+        $string .= "\n";
+    }
     $string .= "#  Environment for any object storage.\n";
     $string .= "\n";
     $string .= "export CANU_OBJECT_STORE_CLIENT="    . getGlobal("objectStoreClient")    . "\n";
@@ -0,0 +1,54 @@
+#!/bin/sh
+
+#  Append overlaps to a store with reads that have no overlaps in the middle
+#  of a store file, and check that no new pieces are made.
+#
+#  Needs a seqStore with at least 300 reads:
+#    ovl-store-append-test.sh <bin-directory> <test.seqStore>
+
+bin=$1
+seq=$2
+
+if [ ! -e "$seq" ] ; then
+  echo Didn\'t find seqStore \'$seq\', can\'t make fake overlaps.
+  exit 1
+fi
+
+rm -rf append-*.ovb append-*.counts append.config append.ovlStore
+
+#  Reads 101-200 have no overlaps, but are in the same (single) file as the
+#  reads on either side.
+
+$bin/overlapImport -S $seq -o append-1.ovb -random 5000 -a   1-100 -b   1-100
+$bin/overlapImport -S $seq -o append-2.ovb -random 5000 -a 201-300 -b 201-300
+
+$bin/ovStoreConfig -S $seq -create append.config append-1.ovb append-2.ovb > append.config.err 2>&1
+$bin/ovStoreBuild  -S $seq -O append.ovlStore -C append.config               > append.build.err  2>&1
+
+before=`ls append.ovlStore | grep -c '<'`
+olapsb=`$bin/ovStoreDump -S $seq -O append.ovlStore 2>/dev/null | wc -l`
+
+#  Add overlaps to reads on both sides of the empty reads.
+
+$bin/overlapImport -S $seq -o append-3.ovb -random 1000 -a   1-50  -b   1-50
+$bin/overlapImport -S $seq -o append-4.ovb -random 1000 -a 250-300 -b 250-300
+
+$bin/ovStoreAppend -S $seq -O append.ovlStore append-3.ovb append-4.ovb > append.append.err 2>&1
+
+after=`ls append.ovlStore | grep -c '<'`
+olapsa=`$bin/ovStoreDump -S $seq -O append.ovlStore 2>/dev/null | wc -l`
+
+echo "pieces:   $before before, $after after"
+echo "overlaps: $olapsb before, $olapsa after"
+
+if [ $before -ne $after ] ; then
+  echo FAIL: appending made new pieces.
+  exit 1
+fi
+
+if [ $olapsa -ne `expr $olapsb + 4000` ] ; then
+  echo FAIL: expected 4000 new overlaps.
+  exit 1
+fi
+
+echo PASS